@@ -0,0 +1,82 @@
+#include <Arduino.h>
+#include <String.h>
+#include "callibration_capture.h"
+#include "logging.h"
+#include "servo_callibration.h"
+
+namespace robotic_arm {
+
+String callibrationPointToString(CallibrationPoint point) {
+  return "{" + String(point.arm_angle) + ", " + String(point.servo_angle) + "}";
+}
+
+String callibrationToString(const ServoCallibration& callibration) {
+  String result = "{";
+  for (int i = 0; i < callibration.size(); i++) {
+    if (i > 0) {
+      result += ", ";
+    }
+    result += callibrationPointToString(callibration.point(i));
+  }
+  return result + "}";
+}
+
+ServoCallibration captureServoCallibration(
+  String name,
+  Servo* servo,
+  const int* servo_angles,
+  int size,
+  int repetitions,
+  unsigned long settle_milliseconds,
+  MeasurementCallback measure,
+  LoggingCallback logging) {
+  ServoCallibrationCapture capture;
+  for (int repetition = 0; repetition < repetitions; repetition++) {
+    // Alternating the direction averages out the backlash of the gears.
+    bool is_reversed = repetition % 2 == 1;
+    for (int step = 0; step < size; step++) {
+      int servo_angle = servo_angles[is_reversed ? size - 1 - step : step];
+      servo->write(servo_angle);
+      delay(settle_milliseconds);
+      double measured_arm_angle = measure(servo_angle);
+      logging(
+        LoggingEnum::DEBUG,
+        "Servo arm " + name + ". Servo write " + String(servo_angle) + " measured at " + String(measured_arm_angle) + " degrees.");
+      if (!capture.addMeasurement(servo_angle, measured_arm_angle)) {
+        logging(
+          LoggingEnum::ERROR,
+          "Servo arm " + name + ". Can't capture more than " + String(MAX_CALLIBRATION_POINTS) + " servo angles.");
+        return ServoCallibration();
+      }
+    }
+  }
+  ServoCallibration callibration = capture.fit();
+  if (callibration.isValid()) {
+    logging(
+      LoggingEnum::INFO,
+      "Servo arm " + name + ". Callibration points: " + callibrationToString(callibration) + ".");
+    return callibration;
+  }
+  int failing_point_index = callibration.failingPointIndex();
+  if (failing_point_index == -1) {
+    logging(
+      LoggingEnum::ERROR,
+      "Servo arm " + name + ". Can't fit a callibration from " + String(capture.size()) + " servo angles.");
+    return callibration;
+  }
+  CallibrationPoint failing_point = callibration.point(failing_point_index);
+  if (isnan(failing_point.arm_angle) || isinf(failing_point.arm_angle)
+    || isnan(failing_point.servo_angle) || isinf(failing_point.servo_angle)) {
+    logging(
+      LoggingEnum::ERROR,
+      "Servo arm " + name + ". Measured point " + callibrationPointToString(failing_point) + " is not finite.");
+    return callibration;
+  }
+  logging(
+    LoggingEnum::ERROR,
+    "Servo arm " + name + ". Measured point " + callibrationPointToString(failing_point) 
+      + " is not monotonic after " + callibrationPointToString(callibration.point(failing_point_index - 1)) + ".");
+  return callibration;
+}
+
+} // namespace robotic_arm
@@ -0,0 +1,38 @@
+#ifndef ROBOTIC_ARM_CALLIBRATION_CAPTURE_H
+#define ROBOTIC_ARM_CALLIBRATION_CAPTURE_H
+
+#include <Servo.h>
+#include <String.h>
+#include "logging.h"
+#include "servo_callibration.h"
+
+namespace robotic_arm {
+
+// Returns the arm angle measured while the servo holds servo_angle, e.g. read
+// from the serial monitor after checking the arm with a protractor.
+typedef double (*MeasurementCallback)(int servo_angle);
+
+String callibrationPointToString(CallibrationPoint point);
+
+// Formatted as the CallibrationPoint array taken by ServoCallibration.
+String callibrationToString(const ServoCallibration& callibration);
+
+// Sweeps the servo over servo_angles, repetitions times in alternating
+// directions, measures the arm at every step and fits a callibration from the
+// measurements. Runs on the board, as there is no host simulator to drive.
+// The fitted table is logged so it can be pasted into a sketch, otherwise the
+// point that is not finite or breaks the monotonicity is logged.
+// See control_scenario_01.ino for an example.
+ServoCallibration captureServoCallibration(
+  String name,
+  Servo* servo,
+  const int* servo_angles,
+  int size,
+  int repetitions,
+  unsigned long settle_milliseconds,
+  MeasurementCallback measure,
+  LoggingCallback logging);
+
+} // namespace robotic_arm
+
+#endif // ROBOTIC_ARM_CALLIBRATION_CAPTURE_H
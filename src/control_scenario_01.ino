@@ -22,6 +22,28 @@ robotic_arm::ServoArm elbow("elbow", &elbow_servo, /*length=*/ 6.7, /*map_range=
 robotic_arm::ServoArm hand("hand", &hand_servo, /*length=*/ 6.0, /*map_range=*/{115, 265, 180, 265, 78, 175}, logging);
 robotic_arm::Robot robot(&shoulder, &elbow, &hand, logging);
 
+// The two-point map ranges above can be replaced by a multi-point callibration
+// captured on the board. Include "callibration_capture.h" and call from setup(),
+// after Serial.begin, while checking the arm with a protractor:
+//
+//   double measureFromSerial(int servo_angle) {
+//     Serial.println("Arm angle at servo write " + String(servo_angle) + "?");
+//     while (!Serial.available()) {}
+//     return Serial.parseFloat();
+//   }
+//
+//   const int shoulder_servo_angles[] = {5, 35, 65, 95};
+//   robotic_arm::captureServoCallibration(
+//     "shoulder", &shoulder_servo, shoulder_servo_angles, /*size=*/4, /*repetitions=*/2,
+//     /*settle_milliseconds=*/1000, measureFromSerial, logging);
+//
+// Then paste the logged callibration points into the arm:
+//
+//   robotic_arm::CallibrationPoint shoulder_points[] = {{94.5, 95}, {121.5, 65}, {148.5, 35}, {175.5, 5}};
+//   robotic_arm::ServoArm shoulder(
+//     "shoulder", &shoulder_servo, /*length=*/ 18.7, /*allowed_range=*/{10, 180},
+//     robotic_arm::ServoCallibration(shoulder_points, 4), logging);
+
 robotic_arm::CartesianJoystick cartesian_joystick(HORZ_PIN, VERT_PIN, /*max_displacement_per_loop=*/0.1);
 robotic_arm::AngularJoystick angular_joystick(ANGLE_PIN, /*max_displacement_per_loop=*/2);
 
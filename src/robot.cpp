@@ -84,7 +84,7 @@ void Robot::_moveByWithExactMethod(
   PlaneCartesianCoordinates delta_cartesian_coordinates,
   double delta_hand_reference_angle) {
   // Current state.
-  PlaneCartesianCoordinates current_cartesian_coordinates = currentCartesianCoordinates();
+  PlaneCartesianCoordinates current_cartesian_coordinates = _calculateCartesianCoordinates(_commandedAngularCoordinates());
   double hand_reference_angle = _getCurrentHandReferenceAngle();
 
   // Projected state.
@@ -112,7 +112,7 @@ void Robot::_moveByWithDerivativeMethod(
   double D = _hand->length();
 
   // Current state.
-  PlaneCartesianCoordinates current_cartesian_coordinates = currentCartesianCoordinates();
+  PlaneCartesianCoordinates current_cartesian_coordinates = _calculateCartesianCoordinates(_commandedAngularCoordinates());
   double hand_reference_angle = _getCurrentHandReferenceAngle();
 
   // Expected state.
@@ -179,15 +179,24 @@ double Robot::_getCurrentHandReferenceAngle(){
   return _shoulder->currentAngle() + _elbow->currentAngle() - _hand->currentAngle() - 90;
 }
 
+Robot::AngularCoordinates Robot::_commandedAngularCoordinates(){
+  return {
+    shoulder_angle: _shoulder->currentAngle(), 
+    elbow_angle: _elbow->currentAngle(),
+    hand_reference_angle: _getCurrentHandReferenceAngle()};
+}
+
 PlaneCartesianCoordinates Robot::currentCartesianCoordinates(){
   return _calculateCartesianCoordinates(currentAngularCoordinates());
 } 
 
 Robot::AngularCoordinates Robot::currentAngularCoordinates(){
+  double shoulder_angle = _shoulder->achievedAngle();
+  double elbow_angle = _elbow->achievedAngle();
   return {
-    shoulder_angle: _shoulder->currentAngle(), 
-    elbow_angle: _elbow->currentAngle(),
-    hand_reference_angle: _getCurrentHandReferenceAngle()};
+    shoulder_angle: shoulder_angle, 
+    elbow_angle: elbow_angle,
+    hand_reference_angle: shoulder_angle + elbow_angle - _hand->achievedAngle() - 90};
 }      
 
 void Robot::moveArmsTo(AngularCoordinates angular_coordinates){
@@ -61,10 +61,15 @@ class Robot {
 
   double _getCurrentHandReferenceAngle();
 
+  // Commanded rather than achieved angles, so that moves smaller than a servo
+  // step still accumulate.
+  AngularCoordinates _commandedAngularCoordinates();
+
   public:
 
     Robot(ServoArm* shoulder_arm, ServoArm* elbow_arm, ServoArm* hand_arm, LoggingCallback logging_callback);
     
+    // Reported from the angles the servos actually reach.
     PlaneCartesianCoordinates currentCartesianCoordinates();
     
     AngularCoordinates currentAngularCoordinates();
@@ -2,32 +2,61 @@
 #include <String.h>
 #include "logging.h"
 #include "servo_arm.h"
+#include "servo_callibration.h"
 
 namespace robotic_arm {
 
 ServoArm::ServoArm(String name, Servo* servo, double length, MapRange map_range, LoggingCallback logging_callback): 
-  _name(name), _servo(servo), _length(length), _map_range(map_range), _current_angle(0.0), 
-  _is_current_angle_set(false), _logging(logging_callback) {
+  _name(name), _length(length), _logging(logging_callback), _servo(servo), 
+  _allowed_range({
+    minimum_allowed_angle: map_range.minimum_allowed_angle, 
+    maximum_allowed_angle: map_range.maximum_allowed_angle}),
+  _callibration(
+    {arm_angle: map_range.first_callibration_angle, servo_angle: map_range.servo_to_first_callibration_angle},
+    {arm_angle: map_range.second_callibration_angle, servo_angle: map_range.servo_to_second_callibration_angle}),
+  _current_angle(0.0), _is_current_angle_set(false) {
+}
+
+ServoArm::ServoArm(String name, Servo* servo, double length, AllowedRange allowed_range, const ServoCallibration& callibration, LoggingCallback logging_callback): 
+  _name(name), _length(length), _logging(logging_callback), _servo(servo), 
+  _allowed_range(allowed_range), _callibration(callibration), 
+  _current_angle(0.0), _is_current_angle_set(false) {
 }
 
 double ServoArm::_transformArmAngleToServoAngle(double angle) {
-  double alpha = (_map_range.second_callibration_angle - angle) / (_map_range.second_callibration_angle - _map_range.first_callibration_angle);
-  return alpha * _map_range.servo_to_first_callibration_angle + (1 - alpha) * _map_range.servo_to_second_callibration_angle;
+  return _callibration.armToServoAngle(angle);
 }  
 
+double ServoArm::_transformServoAngleToArmAngle(double servo_angle) {
+  return _callibration.servoToArmAngle(servo_angle);
+}
+
 int ServoArm::_nearestIntegerAngle(double angle) {
   return floor(angle + 0.5);
 }
 
 String ServoArm::_rangeToString() {
-  return  "[" + String(_map_range.minimum_allowed_angle) + ", " + String(_map_range.maximum_allowed_angle) + "]";
+  return  "[" + String(_allowed_range.minimum_allowed_angle) + ", " + String(_allowed_range.maximum_allowed_angle) + "]";
+}
+
+bool ServoArm::_isCallibrationValid() {
+  if (_callibration.isValid()) {
+    return true;
+  }
+  _logging(
+    LoggingEnum::ERROR, 
+    "Servo arm " + String(_name) + ". Can't move with an invalid callibration.");
+  return false;
 }
 
 bool ServoArm::isAngleAllowed(double angle){
-  return (angle >= _map_range.minimum_allowed_angle) && (angle <= _map_range.maximum_allowed_angle);
+  return (angle >= _allowed_range.minimum_allowed_angle) && (angle <= _allowed_range.maximum_allowed_angle);
 }
 
 bool ServoArm::canMoveTo(double angle){
+  if (!_isCallibrationValid()) {
+    return false;
+  }
   if (isAngleAllowed(angle)) {
     return true;
   }
@@ -38,6 +67,9 @@ bool ServoArm::canMoveTo(double angle){
 }
 
 bool ServoArm::canMoveBy(double delta_angle){
+  if (!_isCallibrationValid()) {
+    return false;
+  }
   if (!_is_current_angle_set) {
     _logging(
       LoggingEnum::INFO, 
@@ -68,7 +100,8 @@ void ServoArm::moveTo(double angle){
   int servo_angle = ServoArm::_nearestIntegerAngle(ServoArm::_transformArmAngleToServoAngle(_current_angle));
   _logging(
     LoggingEnum::INFO,
-    "Moving arm " + _name + " to position " + String(_current_angle) + " degrees via servo write " + String(servo_angle) + " degrees."
+    "Moving arm " + _name + " to position " + String(_current_angle) + " degrees via servo write " + String(servo_angle) 
+      + " degrees. Achieved position " + String(_transformServoAngleToArmAngle(servo_angle)) + " degrees."
   );
   _servo->write(servo_angle);
 }
@@ -90,6 +123,16 @@ double ServoArm::currentAngle() {
   return _current_angle;
 }
 
+double ServoArm::achievedAngle() {
+  if (!_is_current_angle_set) {
+    _logging(
+      LoggingEnum::ERROR, 
+      "Servo arm " + String(_name) + ". Trying to call achievedAngle without setting the arm to an initial angle.");
+    return 0;
+  }
+  return _transformServoAngleToArmAngle(_nearestIntegerAngle(_transformArmAngleToServoAngle(_current_angle)));
+}
+
 double ServoArm::length() {
   return _length;
 }
@@ -4,6 +4,7 @@
 #include <Servo.h>
 #include <String.h>
 #include "logging.h"
+#include "servo_callibration.h"
 
 namespace robotic_arm {
 
@@ -22,21 +23,33 @@ class ServoArm {
     double servo_to_first_callibration_angle;
     double servo_to_second_callibration_angle;
   };
-  const MapRange _map_range;
+
+  struct AllowedRange {
+    double minimum_allowed_angle;
+    double maximum_allowed_angle;
+  };
+  const AllowedRange _allowed_range;
+  const ServoCallibration _callibration;
     
   double _current_angle;
   bool _is_current_angle_set;
 
   double _transformArmAngleToServoAngle(double angle);
 
+  double _transformServoAngleToArmAngle(double servo_angle);
+
   int _nearestIntegerAngle(double angle);
 
   String _rangeToString();
 
+  bool _isCallibrationValid();
+
   public:
 
     ServoArm(String name, Servo* servo, double length, MapRange map_range, LoggingCallback logging_callback);
 
+    ServoArm(String name, Servo* servo, double length, AllowedRange allowed_range, const ServoCallibration& callibration, LoggingCallback logging_callback);
+
     void moveTo(double angle);
 
     void moveBy(double delta_angle);
@@ -49,13 +62,19 @@ class ServoArm {
 
     double currentAngle();
 
-    double minAngle() {return _map_range.minimum_allowed_angle;}
+    // Angle the arm actually reaches once the commanded angle is rounded to a servo write.
+    double achievedAngle();
 
-    double maxAngle() {return _map_range.maximum_allowed_angle;}
+    double minAngle() {return _allowed_range.minimum_allowed_angle;}
 
-    double firstCallibrationAngle() {return _map_range.first_callibration_angle;}
+    double maxAngle() {return _allowed_range.maximum_allowed_angle;}
+
+    // Lowest and highest callibrated arm angles.
+    double firstCallibrationAngle() {return _callibration.point(0).arm_angle;}
     
-    double secondCallibrationAngle() {return _map_range.second_callibration_angle;}
+    double secondCallibrationAngle() {return _callibration.point(_callibration.size() - 1).arm_angle;}
+
+    const ServoCallibration& callibration() {return _callibration;}
 
     double length();
     
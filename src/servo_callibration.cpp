@@ -0,0 +1,166 @@
+#include "servo_callibration.h"
+
+// Compiler builtins instead of <math.h>, which the project's own math.h
+// shadows once src is on the include path.
+#define CALLIBRATION_NAN __builtin_nan("")
+
+namespace robotic_arm {
+
+ServoCallibration::ServoCallibration(): 
+  _size(0), _is_valid(false), _failing_point_index(-1), _servo_direction(1) {
+}
+
+ServoCallibration::ServoCallibration(const CallibrationPoint* points, int size):
+  _size(0), _is_valid(false), _failing_point_index(-1), _servo_direction(1) {
+  _initialize(points, size);
+}
+
+ServoCallibration::ServoCallibration(CallibrationPoint first_point, CallibrationPoint second_point):
+  _size(0), _is_valid(false), _failing_point_index(-1), _servo_direction(1) {
+  CallibrationPoint points[] = {first_point, second_point};
+  _initialize(points, 2);
+}
+
+void ServoCallibration::_initialize(const CallibrationPoint* points, int size) {
+  if (size < 2 || size > MAX_CALLIBRATION_POINTS) {
+    return;
+  }
+  _size = size;
+  for (int i = 0; i < _size; i++) {
+    _arm_angles[i] = points[i].arm_angle;
+    _servo_angles[i] = points[i].servo_angle;
+  }
+  // Comparisons with NaN are always false, so they would pass the checks below.
+  _failing_point_index = _findNonFinitePoint();
+  if (_failing_point_index != -1) {
+    return;
+  }
+  _sortByArmAngle();
+  _servo_direction = _servo_angles[1] > _servo_angles[0] ? 1 : -1;
+  _failing_point_index = _findNonMonotonicPoint();
+  if (_failing_point_index != -1) {
+    return;
+  }
+  _precomputeSlopes();
+  _is_valid = true;
+}
+
+void ServoCallibration::_sortByArmAngle() {
+  // Insertion sort, the tables are tiny.
+  for (int i = 1; i < _size; i++) {
+    double arm_angle = _arm_angles[i];
+    double servo_angle = _servo_angles[i];
+    int j = i - 1;
+    while (j >= 0 && _arm_angles[j] > arm_angle) {
+      _arm_angles[j + 1] = _arm_angles[j];
+      _servo_angles[j + 1] = _servo_angles[j];
+      j--;
+    }
+    _arm_angles[j + 1] = arm_angle;
+    _servo_angles[j + 1] = servo_angle;
+  }
+}
+
+int ServoCallibration::_findNonFinitePoint() {
+  for (int i = 0; i < _size; i++) {
+    if (!__builtin_isfinite(_arm_angles[i]) || !__builtin_isfinite(_servo_angles[i])) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int ServoCallibration::_findNonMonotonicPoint() {
+  for (int i = 1; i < _size; i++) {
+    if (_arm_angles[i] <= _arm_angles[i - 1]) {
+      return i;
+    }
+    if ((_servo_angles[i] - _servo_angles[i - 1]) * _servo_direction <= 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void ServoCallibration::_precomputeSlopes() {
+  for (int i = 0; i < _size - 1; i++) {
+    double delta_arm_angle = _arm_angles[i + 1] - _arm_angles[i];
+    double delta_servo_angle = _servo_angles[i + 1] - _servo_angles[i];
+    _arm_to_servo_slopes[i] = delta_servo_angle / delta_arm_angle;
+    _servo_to_arm_slopes[i] = delta_arm_angle / delta_servo_angle;
+  }
+}
+
+int ServoCallibration::_armSegment(double arm_angle) const {
+  for (int i = 1; i < _size - 1; i++) {
+    if (arm_angle < _arm_angles[i]) {
+      return i - 1;
+    }
+  }
+  return _size - 2;
+}
+
+int ServoCallibration::_servoSegment(double servo_angle) const {
+  for (int i = 1; i < _size - 1; i++) {
+    if ((servo_angle - _servo_angles[i]) * _servo_direction < 0) {
+      return i - 1;
+    }
+  }
+  return _size - 2;
+}
+
+CallibrationPoint ServoCallibration::point(int index) const {
+  if (index < 0 || index >= _size) {
+    return {arm_angle: CALLIBRATION_NAN, servo_angle: CALLIBRATION_NAN};
+  }
+  return {arm_angle: _arm_angles[index], servo_angle: _servo_angles[index]};
+}
+
+double ServoCallibration::armToServoAngle(double arm_angle) const {
+  if (!_is_valid) {
+    return CALLIBRATION_NAN;
+  }
+  int segment = _armSegment(arm_angle);
+  return _servo_angles[segment] + _arm_to_servo_slopes[segment] * (arm_angle - _arm_angles[segment]);
+}
+
+double ServoCallibration::servoToArmAngle(double servo_angle) const {
+  if (!_is_valid) {
+    return CALLIBRATION_NAN;
+  }
+  int segment = _servoSegment(servo_angle);
+  return _arm_angles[segment] + _servo_to_arm_slopes[segment] * (servo_angle - _servo_angles[segment]);
+}
+
+ServoCallibrationCapture::ServoCallibrationCapture(): _size(0) {
+}
+
+bool ServoCallibrationCapture::addMeasurement(int servo_angle, double measured_arm_angle) {
+  for (int i = 0; i < _size; i++) {
+    if (_servo_angles[i] == servo_angle) {
+      _arm_angle_sums[i] += measured_arm_angle;
+      _measurement_counts[i]++;
+      return true;
+    }
+  }
+  if (_size == MAX_CALLIBRATION_POINTS) {
+    return false;
+  }
+  _servo_angles[_size] = servo_angle;
+  _arm_angle_sums[_size] = measured_arm_angle;
+  _measurement_counts[_size] = 1;
+  _size++;
+  return true;
+}
+
+ServoCallibration ServoCallibrationCapture::fit() const {
+  CallibrationPoint points[MAX_CALLIBRATION_POINTS];
+  for (int i = 0; i < _size; i++) {
+    points[i] = {
+      arm_angle: _arm_angle_sums[i] / _measurement_counts[i],
+      servo_angle: (double) _servo_angles[i]};
+  }
+  return ServoCallibration(points, _size);
+}
+
+} // namespace robotic_arm
@@ -0,0 +1,102 @@
+#ifndef ROBOTIC_ARM_SERVO_CALLIBRATION_H
+#define ROBOTIC_ARM_SERVO_CALLIBRATION_H
+
+namespace robotic_arm {
+
+const int MAX_CALLIBRATION_POINTS = 6;
+
+struct CallibrationPoint {
+  double arm_angle;
+  double servo_angle;
+};
+
+// Piecewise linear mapping between arm angles and servo angles.
+// The points are sorted by arm angle on construction and the slopes of every
+// segment are precomputed in both directions, so that looking up an angle only
+// needs multiplications. Angles outside of the callibrated interval are
+// extrapolated with the first or last segment.
+// An invalid callibration returns NAN from every lookup.
+class ServoCallibration {
+
+  int _size;
+  bool _is_valid;
+  int _failing_point_index;
+  // +1 if the servo angle grows with the arm angle, -1 otherwise.
+  int _servo_direction;
+
+  double _arm_angles[MAX_CALLIBRATION_POINTS];
+  double _servo_angles[MAX_CALLIBRATION_POINTS];
+  double _arm_to_servo_slopes[MAX_CALLIBRATION_POINTS - 1];
+  double _servo_to_arm_slopes[MAX_CALLIBRATION_POINTS - 1];
+
+  void _initialize(const CallibrationPoint* points, int size);
+
+  void _sortByArmAngle();
+
+  int _findNonFinitePoint();
+
+  int _findNonMonotonicPoint();
+
+  void _precomputeSlopes();
+
+  int _armSegment(double arm_angle) const;
+
+  int _servoSegment(double servo_angle) const;
+
+  public:
+
+    // Invalid callibration, only meant to be reassigned.
+    ServoCallibration();
+
+    // Requires at least two finite points with distinct arm angles and servo
+    // angles which are strictly increasing or strictly decreasing with the arm angle.
+    ServoCallibration(const CallibrationPoint* points, int size);
+
+    ServoCallibration(CallibrationPoint first_point, CallibrationPoint second_point);
+
+    bool isValid() const {return _is_valid;}
+
+    // Index of the first non finite point, in the given order, or otherwise of
+    // the first point breaking the monotonicity, in arm angle order.
+    // -1 if the callibration is valid or has a wrong number of points.
+    int failingPointIndex() const {return _failing_point_index;}
+
+    int size() const {return _size;}
+
+    // NAN angles if the index is out of range.
+    CallibrationPoint point(int index) const;
+
+    double armToServoAngle(double arm_angle) const;
+
+    double servoToArmAngle(double servo_angle) const;
+
+};
+
+// Accumulates measured arm angles for commanded servo angles and fits a
+// ServoCallibration from them. Repeated measurements for the same servo angle
+// are averaged. Has no dependency on the Arduino core.
+class ServoCallibrationCapture {
+
+  int _size;
+  int _servo_angles[MAX_CALLIBRATION_POINTS];
+  double _arm_angle_sums[MAX_CALLIBRATION_POINTS];
+  int _measurement_counts[MAX_CALLIBRATION_POINTS];
+
+  public:
+
+    ServoCallibrationCapture();
+
+    // Returns false if a new servo angle does not fit in the table anymore.
+    bool addMeasurement(int servo_angle, double measured_arm_angle);
+
+    int size() const {return _size;}
+
+    // The result is invalid if the averaged measurements are not finite or not monotonic,
+    // see ServoCallibration::failingPointIndex.
+    ServoCallibration fit() const;
+
+};
+
+} // namespace robotic_arm
+
+#endif // ROBOTIC_ARM_SERVO_CALLIBRATION_H